@@ -0,0 +1,160 @@
+#include <drogon/HttpController.h>
+#include <pugixml.hpp>
+#include <json/json.h>
+#include <sstream>
+#include "converters/NameTable.h"
+#include "converters/XmlJson.h"
+
+using namespace drogon;
+
+// Schema-free XML <-> JSON conversion for arbitrary documents
+class GenericController : public drogon::HttpController<GenericController> {
+public:
+    METHOD_LIST_BEGIN
+        ADD_METHOD_TO(GenericController::toJson, "/convert/generic/tojson", Post);
+        ADD_METHOD_TO(GenericController::toXml, "/convert/generic/toxml", Post);
+        ADD_METHOD_TO(GenericController::nameStats, "/convert/names/stats", Get);
+    METHOD_LIST_END
+
+    void toJson(const HttpRequestPtr &req,
+                std::function<void(const HttpResponsePtr &)> &&callback)
+    {
+        try
+        {
+            std::string xmlContent(req->getBody());
+            pugi::xml_document doc;
+
+            if (!doc.load_string(xmlContent.c_str()))
+            {
+                auto resp = HttpResponse::newHttpResponse();
+                resp->setStatusCode(k400BadRequest);
+                resp->setBody("Invalid XML");
+                callback(resp);
+                return;
+            }
+
+            // Optional query parameter: XPath expression
+            std::string xpathExpr = req->getParameter("xpath");
+            Json::Value j;
+
+            // One budget for the whole request, however many nodes match
+            NameTable::Budget budget;
+
+            if (!xpathExpr.empty())
+            {
+                pugi::xpath_node_set nodes = doc.select_nodes(xpathExpr.c_str());
+
+                if (nodes.size() > 1)
+                {
+                    // Multiple matches → JSON array of {name: node}
+                    j = Json::Value(Json::arrayValue);
+                    for (auto &n : nodes)
+                    {
+                        Json::Value obj;
+                        obj[n.node().name()] = xmljson::xmlNodeToJson(n.node(), budget);
+                        j.append(obj);
+                    }
+                }
+                else if (!nodes.empty())
+                {
+                    pugi::xml_node n = nodes.begin()->node();
+                    j[n.name()] = xmljson::xmlNodeToJson(n, budget);
+                }
+            }
+
+            // Default: convert from the document's root element
+            if (j.isNull())
+            {
+                pugi::xml_node rootNode = doc.first_child();
+                j[rootNode.name()] = xmljson::xmlNodeToJson(rootNode, budget);
+            }
+
+            Json::StreamWriterBuilder writer;
+            auto resp = HttpResponse::newHttpResponse();
+            resp->setContentTypeCode(CT_APPLICATION_JSON);
+            resp->setBody(Json::writeString(writer, j));
+            callback(resp);
+        }
+        catch (const std::exception &ex)
+        {
+            auto resp = HttpResponse::newHttpResponse();
+            resp->setStatusCode(k400BadRequest);
+            resp->setContentTypeCode(CT_TEXT_PLAIN);
+            resp->setBody(std::string("Exception: ") + ex.what());
+            callback(resp);
+        }
+    }
+
+    void toXml(const HttpRequestPtr &req,
+               std::function<void(const HttpResponsePtr &)> &&callback)
+    {
+        try
+        {
+            std::string jsonStr(req->getBody());
+
+            Json::CharReaderBuilder reader;
+            Json::Value j;
+            std::string errs;
+            std::istringstream iss(jsonStr);
+
+            if (!Json::parseFromStream(reader, iss, &j, &errs))
+            {
+                auto resp = HttpResponse::newHttpResponse();
+                resp->setStatusCode(k400BadRequest);
+                resp->setBody("Invalid JSON");
+                callback(resp);
+                return;
+            }
+
+            pugi::xml_document doc;
+            pugi::xml_node root;
+
+            // A single root key names the root element
+            if (j.isObject() && j.size() == 1)
+            {
+                std::string rootName = j.begin().name();
+                root = doc.append_child(rootName.c_str());
+                xmljson::jsonToXmlNode(*j.begin(), root);
+            }
+            else
+            {
+                root = doc.append_child("root");
+                xmljson::jsonToXmlNode(j, root);
+            }
+
+            std::ostringstream oss;
+            doc.save(oss, "  ");
+
+            auto resp = HttpResponse::newHttpResponse();
+            resp->setContentTypeCode(CT_APPLICATION_XML);
+            resp->setBody(oss.str());
+            callback(resp);
+        }
+        catch (const std::exception &ex)
+        {
+            auto resp = HttpResponse::newHttpResponse();
+            resp->setStatusCode(k400BadRequest);
+            resp->setContentTypeCode(CT_TEXT_PLAIN);
+            resp->setBody(std::string("Exception: ") + ex.what());
+            callback(resp);
+        }
+    }
+
+    // Interned name table counters; see NameTable::Stats for the hit rate
+    void nameStats(const HttpRequestPtr &,
+                   std::function<void(const HttpResponsePtr &)> &&callback)
+    {
+        NameTable::Stats s = NameTable::instance().stats();
+
+        Json::Value j;
+        j["hits"] = Json::UInt64(s.hits);
+        j["misses"] = Json::UInt64(s.misses);
+        j["rejected"] = Json::UInt64(s.rejected);
+        j["size"] = Json::UInt64(s.size);
+        j["capacity"] = Json::UInt64(s.capacity);
+        j["full"] = s.full;
+        j["hit_rate"] = s.hitRate();
+
+        callback(HttpResponse::newHttpJsonResponse(j));
+    }
+};
@@ -0,0 +1,129 @@
+#include "NameTable.h"
+#include <functional>
+
+namespace
+{
+    std::size_t slotCountFor(std::size_t maxEntries)
+    {
+        // Power of two, at most half full, so probing always reaches an empty slot
+        std::size_t n = 1;
+        while (n < 2 * maxEntries)
+            n <<= 1;
+        return n;
+    }
+}
+
+double NameTable::Stats::hitRate() const
+{
+    std::uint64_t lookups = hits + misses + rejected;
+    return lookups ? double(hits) / double(lookups) : 0.0;
+}
+
+NameTable::NameTable(std::size_t maxEntries)
+    : maxEntries_(maxEntries),
+      mask_(slotCountFor(maxEntries) - 1),
+      slots_(new std::atomic<const Entry *>[mask_ + 1])
+{
+    for (std::size_t i = 0; i <= mask_; ++i)
+        slots_[i].store(nullptr, std::memory_order_relaxed);
+}
+
+NameTable &NameTable::instance()
+{
+    static NameTable table;
+    return table;
+}
+
+NameTable::Counters &NameTable::localCounters()
+{
+    static std::atomic<std::size_t> nextShard{0};
+    thread_local std::size_t shard =
+        nextShard.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return counters_[shard];
+}
+
+const NameTable::Entry *NameTable::find(std::string_view name, std::size_t hash) const
+{
+    for (std::size_t i = hash & mask_;; i = (i + 1) & mask_)
+    {
+        const Entry *e = slots_[i].load(std::memory_order_acquire);
+        if (!e)
+            return nullptr;
+        if (e->hash == hash && e->name == name)
+            return e;
+    }
+}
+
+const NameTable::Entry *NameTable::intern(std::string_view name, Budget &budget)
+{
+    if (name.empty())
+        return nullptr;
+
+    Counters &counters = localCounters();
+
+    if (name.size() > kMaxNameLength)
+    {
+        counters.rejected.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    // Fast path: name already interned, no lock taken
+    std::size_t hash = std::hash<std::string_view>{}(name);
+    if (const Entry *e = find(name, hash))
+    {
+        counters.hits.fetch_add(1, std::memory_order_relaxed);
+        return e;
+    }
+
+    // Reject before touching the write lock, so a flood of unique names
+    // against a full table does not serialize every converter thread
+    if (budget.remaining == 0 || size_.load(std::memory_order_relaxed) >= maxEntries_)
+    {
+        counters.rejected.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
+
+    // Another thread may have added it while we were waiting
+    if (const Entry *e = find(name, hash))
+    {
+        counters.hits.fetch_add(1, std::memory_order_relaxed);
+        return e;
+    }
+
+    if (entries_.size() >= maxEntries_)
+    {
+        counters.rejected.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Entry &e = entries_.emplace_back();
+    e.hash = hash;
+    e.name.assign(name.data(), name.size());
+    e.attrKey = "@" + e.name;
+
+    // Publish only after the entry is fully built; readers load with acquire
+    std::size_t i = hash & mask_;
+    while (slots_[i].load(std::memory_order_relaxed))
+        i = (i + 1) & mask_;
+    slots_[i].store(&e, std::memory_order_release);
+    size_.store(entries_.size(), std::memory_order_relaxed);
+
+    --budget.remaining;
+    counters.misses.fetch_add(1, std::memory_order_relaxed);
+    return &e;
+}
+
+NameTable::Stats NameTable::stats() const
+{
+    Stats s{0, 0, 0, size_.load(std::memory_order_relaxed), maxEntries_, false};
+    for (const Counters &c : counters_)
+    {
+        s.hits += c.hits.load(std::memory_order_relaxed);
+        s.misses += c.misses.load(std::memory_order_relaxed);
+        s.rejected += c.rejected.load(std::memory_order_relaxed);
+    }
+    s.full = s.size >= s.capacity;
+    return s;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// Process-wide table of interned element/attribute names.
+//
+// Documents repeat the same few hundred names over and over, so each name is
+// stored once and shared by every request. Entries are never removed, which
+// keeps the returned pointers (and their c_str()) valid for the whole process
+// lifetime.
+//
+// Lookups are lock-free: names live in a fixed open-addressed slot array that
+// is only ever appended to, under a mutex, by callers adding a new name.
+//
+// Bound policy: the table holds at most `maxEntries` names and never evicts.
+// Once it is full every unseen name is rejected until the process restarts,
+// so the first names admitted win. To keep a single document from filling it,
+// each request may only admit `kMaxNewNamesPerRequest` new names: callers
+// create one Budget per request and pass it to every intern() call. A
+// sustained stream of hostile requests can still fill it; `full` in Stats
+// reports when that has happened.
+class NameTable
+{
+public:
+    struct Entry
+    {
+        std::size_t hash;
+        std::string name;     // element / attribute name, e.g. "title"
+        std::string attrKey;  // JSON key used for attributes, e.g. "@title"
+    };
+
+    struct Stats
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;    // new names added to the table
+        std::uint64_t rejected;  // too long, table full or request budget spent
+        std::size_t size;
+        std::size_t capacity;
+        bool full;
+
+        // hits / (hits + misses + rejected). Empty names are never looked up,
+        // so they do not count; rejected names do, since they cost a lookup.
+        double hitRate() const;
+    };
+
+    // New names a single request may add to the table
+    struct Budget
+    {
+        std::size_t remaining = kMaxNewNamesPerRequest;
+    };
+
+    static constexpr std::size_t kMaxEntries = 4096;
+    static constexpr std::size_t kMaxNameLength = 256;
+    static constexpr std::size_t kMaxNewNamesPerRequest = 64;
+
+    explicit NameTable(std::size_t maxEntries = kMaxEntries);
+
+    NameTable(const NameTable &) = delete;
+    NameTable &operator=(const NameTable &) = delete;
+
+    static NameTable &instance();
+
+    // Returns the interned entry for `name`, or nullptr if the name is empty
+    // or was rejected; callers then fall back to a plain std::string.
+    // Adding a new name spends one unit of `budget`.
+    const Entry *intern(std::string_view name, Budget &budget);
+
+    Stats stats() const;
+
+private:
+    // Hit/miss counters are sharded per thread so that lookups from different
+    // threads do not bounce a shared cache line
+    struct alignas(64) Counters
+    {
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+        std::atomic<std::uint64_t> rejected{0};
+    };
+    static constexpr std::size_t kShards = 16;
+
+    Counters &localCounters();
+    const Entry *find(std::string_view name, std::size_t hash) const;
+
+    const std::size_t maxEntries_;
+    const std::size_t mask_;  // slot count - 1, slot count >= 2 * maxEntries_
+    std::unique_ptr<std::atomic<const Entry *>[]> slots_;
+    std::atomic<std::size_t> size_{0};
+
+    std::mutex writeMutex_;      // guards entries_ and slot insertion
+    std::deque<Entry> entries_;  // deque: references stay valid on push_back
+
+    Counters counters_[kShards];
+};
@@ -0,0 +1,128 @@
+#include "XmlJson.h"
+#include <string>
+#include <string_view>
+
+namespace
+{
+    Json::Value toJson(const pugi::xml_node &node, NameTable &names, NameTable::Budget &budget)
+    {
+        Json::Value j;
+
+        for (auto &attr : node.attributes())
+        {
+            // Interned keys live for the whole process, so jsoncpp can keep a
+            // pointer to them instead of copying the key into every member
+            if (const NameTable::Entry *e = names.intern(attr.name(), budget))
+                j[Json::StaticString(e->attrKey.c_str())] = attr.value();
+            else
+                j["@" + std::string(attr.name())] = attr.value();
+        }
+
+        for (auto &child : node.children())
+        {
+            const char *name = child.name();
+
+            if (*name)
+            {
+                // `j` is only ever null or an object here (the "_text" path
+                // below just sets a member), so size() counts its members and
+                // growing by one means operator[] created a new member
+                Json::ArrayIndex before = j.size();
+                const NameTable::Entry *e = names.intern(name, budget);
+                Json::Value &member = e ? j[Json::StaticString(e->name.c_str())]
+                                        : j[std::string(name)];
+
+                if (j.size() == before)
+                {
+                    if (!member.isArray())
+                    {
+                        Json::Value tmp = member;
+                        member = Json::Value(Json::arrayValue);
+                        member.append(tmp);
+                    }
+                    member.append(toJson(child, names, budget));
+                }
+                else
+                {
+                    member = toJson(child, names, budget);
+                }
+            }
+            else if (child.type() == pugi::node_pcdata || child.type() == pugi::node_cdata)
+            {
+                // Handle text and CDATA content
+                j["_text"] = child.value();
+            }
+        }
+
+        // Leaf node case (no children, just text or CDATA)
+        if (j.empty() && (node.type() == pugi::node_pcdata || node.type() == pugi::node_cdata))
+        {
+            return Json::Value(node.value());
+        }
+
+        return j;
+    }
+}
+
+namespace xmljson
+{
+    Json::Value xmlNodeToJson(const pugi::xml_node &node)
+    {
+        NameTable::Budget budget;
+        return xmlNodeToJson(node, budget);
+    }
+
+    Json::Value xmlNodeToJson(const pugi::xml_node &node, NameTable::Budget &budget)
+    {
+        return toJson(node, NameTable::instance(), budget);
+    }
+
+    void jsonToXmlNode(const Json::Value &j, pugi::xml_node &node)
+    {
+        if (j.isObject())
+        {
+            for (auto it = j.begin(); it != j.end(); ++it)
+            {
+                // View the key in place instead of copying it out of jsoncpp.
+                // jsoncpp keeps keys null-terminated and pugixml copies names
+                // into its own storage, so `key` can be passed straight on.
+                const char *end = nullptr;
+                const char *key = it.memberName(&end);
+                std::string_view view(key, end - key);
+
+                if (!view.empty() && view[0] == '@')
+                {
+                    // JSON "@attr" → XML attribute
+                    node.append_attribute(key + 1).set_value(it->asCString());
+                }
+                else if (view == "_text")
+                {
+                    // JSON "_text" → XML text content
+                    node.text().set(it->asCString());
+                }
+                else
+                {
+                    // Handle nested objects or arrays
+                    if (it->isArray())
+                    {
+                        for (const auto &el : *it)
+                        {
+                            pugi::xml_node child = node.append_child(key);
+                            jsonToXmlNode(el, child);
+                        }
+                    }
+                    else
+                    {
+                        pugi::xml_node child = node.append_child(key);
+                        jsonToXmlNode(*it, child);
+                    }
+                }
+            }
+        }
+        else if (j.isString() || j.isNumeric() || j.isBool())
+        {
+            // Plain value → text node
+            node.text().set(j.asCString());
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <pugixml.hpp>
+#include <json/json.h>
+#include "NameTable.h"
+
+// Generic XML <-> JSON mapping:
+//   attributes          <-> "@name" keys
+//   text / CDATA         <-> "_text"
+//   repeated siblings    <-> JSON arrays
+namespace xmljson
+{
+    // recursively convert an XML node to JSON
+    Json::Value xmlNodeToJson(const pugi::xml_node &node);
+
+    // Same, spending new interned names from `budget`. Callers converting
+    // several nodes for one request pass the same budget to every call.
+    Json::Value xmlNodeToJson(const pugi::xml_node &node, NameTable::Budget &budget);
+
+    // recursively convert JSON to XML under `node`
+    void jsonToXmlNode(const Json::Value &j, pugi::xml_node &node);
+}
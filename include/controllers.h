@@ -34,3 +34,22 @@ public:
     void convertJsonToXml(const drogon::HttpRequestPtr &req,
                           std::function<void(const drogon::HttpResponsePtr &)> &&callback);
 };
+
+class API GenericController : public drogon::HttpController<GenericController>
+{
+public:
+    METHOD_LIST_BEGIN
+        ADD_METHOD_TO(GenericController::toJson, "/convert/generic/tojson", Post);
+        ADD_METHOD_TO(GenericController::toXml, "/convert/generic/toxml", Post);
+        ADD_METHOD_TO(GenericController::nameStats, "/convert/names/stats", Get);
+    METHOD_LIST_END
+
+    void toJson(const drogon::HttpRequestPtr &req,
+                std::function<void(const drogon::HttpResponsePtr &)> &&callback);
+
+    void toXml(const drogon::HttpRequestPtr &req,
+               std::function<void(const drogon::HttpResponsePtr &)> &&callback);
+
+    void nameStats(const drogon::HttpRequestPtr &req,
+                   std::function<void(const drogon::HttpResponsePtr &)> &&callback);
+};
@@ -0,0 +1,175 @@
+#include <drogon/drogon_test.h>
+#include <pugixml.hpp>
+#include <json/json.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include "converters/NameTable.h"
+#include "converters/XmlJson.h"
+
+DROGON_TEST(NameTableCounting)
+{
+    NameTable table(8);
+    NameTable::Budget budget;
+
+    const NameTable::Entry *a = table.intern("title", budget);
+    REQUIRE(a != nullptr);
+    CHECK(a->name == "title");
+    CHECK(a->attrKey == "@title");
+    CHECK(table.intern(std::string("title"), budget) == a);
+
+    // Empty names are not lookups and are not counted
+    CHECK(table.intern("", budget) == nullptr);
+
+    CHECK(table.intern(std::string(NameTable::kMaxNameLength, 'x'), budget) != nullptr);
+    CHECK(table.intern(std::string(NameTable::kMaxNameLength + 1, 'x'), budget) == nullptr);
+
+    NameTable::Stats s = table.stats();
+    CHECK(s.hits == 1);
+    CHECK(s.misses == 2);
+    CHECK(s.rejected == 1);
+    CHECK(s.size == 2);
+    CHECK(s.capacity == 8);
+    CHECK(!s.full);
+    CHECK(s.hitRate() == 0.25);
+}
+
+DROGON_TEST(NameTableCapacity)
+{
+    NameTable table(NameTable::kMaxEntries);
+    NameTable::Budget budget{NameTable::kMaxEntries + 1};
+
+    for (std::size_t i = 0; i < NameTable::kMaxEntries; ++i)
+        REQUIRE(table.intern("n" + std::to_string(i), budget) != nullptr);
+
+    CHECK(table.intern("one_too_many", budget) == nullptr);
+    // Names already in a full table still hit
+    CHECK(table.intern("n0", budget) != nullptr);
+
+    NameTable::Stats s = table.stats();
+    CHECK(s.size == NameTable::kMaxEntries);
+    CHECK(s.full);
+    CHECK(s.misses == NameTable::kMaxEntries);
+    CHECK(s.rejected == 1);
+    CHECK(s.hits == 1);
+}
+
+DROGON_TEST(NameTableRequestBudget)
+{
+    NameTable table(64);
+    NameTable::Budget budget{2};
+
+    CHECK(table.intern("a", budget) != nullptr);
+    CHECK(table.intern("b", budget) != nullptr);
+    CHECK(table.intern("c", budget) == nullptr);
+    CHECK(table.intern("a", budget) != nullptr);
+
+    // A fresh request gets a fresh budget
+    NameTable::Budget next;
+    CHECK(table.intern("c", next) != nullptr);
+}
+
+DROGON_TEST(XmlToJsonRepeatedSiblings)
+{
+    pugi::xml_document doc;
+    REQUIRE(doc.load_string("<r><a x=\"1\"/><a/><a>t</a><b>u</b></r>"));
+
+    Json::Value j = xmljson::xmlNodeToJson(doc.first_child());
+    // Interned keys must survive a copy of the value
+    Json::Value copy = j;
+
+    REQUIRE(copy["a"].isArray());
+    CHECK(copy["a"].size() == 3);
+    CHECK(copy["a"][0]["@x"].asString() == "1");
+    CHECK(copy["a"][1].isNull());
+    CHECK(copy["a"][2]["_text"].asString() == "t");
+    CHECK(copy["b"]["_text"].asString() == "u");
+}
+
+DROGON_TEST(XmlJsonRoundTrip)
+{
+    // Children in key order, since jsoncpp sorts object members
+    const char *xml = "<book id=\"7\" lang=\"en\"><author>A</author><title>T</title></book>";
+
+    pugi::xml_document in;
+    REQUIRE(in.load_string(xml));
+    Json::Value j = xmljson::xmlNodeToJson(in.first_child());
+
+    pugi::xml_document out;
+    pugi::xml_node root = out.append_child("book");
+    xmljson::jsonToXmlNode(j, root);
+
+    std::ostringstream a, b;
+    in.save(a, "  ");
+    out.save(b, "  ");
+    CHECK(a.str() == b.str());
+}
+
+DROGON_TEST(XpathMatchesShareOneBudget)
+{
+    // 4 matches x 32 new names = 128, twice the per-request allowance
+    std::string xml = "<r>";
+    for (int g = 0; g < 4; ++g)
+    {
+        xml += "<g>";
+        for (int i = 0; i < 32; ++i)
+            xml += "<xp_" + std::to_string(g) + "_" + std::to_string(i) + "/>";
+        xml += "</g>";
+    }
+    xml += "</r>";
+
+    pugi::xml_document doc;
+    REQUIRE(doc.load_string(xml.c_str()));
+    pugi::xpath_node_set nodes = doc.select_nodes("//g");
+    REQUIRE(nodes.size() == 4);
+
+    std::uint64_t missesBefore = NameTable::instance().stats().misses;
+
+    // As GenericController::toJson does: one budget for every match
+    NameTable::Budget budget;
+    for (auto &n : nodes)
+        xmljson::xmlNodeToJson(n.node(), budget);
+
+    CHECK(budget.remaining == 0);
+    // "g" itself is not looked up; only its children are
+    CHECK(NameTable::instance().stats().misses - missesBefore ==
+          NameTable::kMaxNewNamesPerRequest);
+}
+
+DROGON_TEST(XmlToJsonPastBudgetFallsBack)
+{
+    const std::size_t count = NameTable::kMaxNewNamesPerRequest + 16;
+
+    // Each child has a unique element and attribute name, and the last one
+    // is repeated, so the fallback path has to build an array too
+    std::string xml = "<r>";
+    for (std::size_t i = 0; i < count; ++i)
+        xml += "<fb_e" + std::to_string(i) + " fb_a" + std::to_string(i) + "=\"v\"/>";
+    std::string last = "fb_e" + std::to_string(count - 1);
+    xml += "<" + last + "/></r>";
+
+    pugi::xml_document doc;
+    REQUIRE(doc.load_string(xml.c_str()));
+
+    std::uint64_t rejectedBefore = NameTable::instance().stats().rejected;
+    NameTable::Budget budget;
+    Json::Value j = xmljson::xmlNodeToJson(doc.first_child(), budget);
+
+    CHECK(budget.remaining == 0);
+    CHECK(NameTable::instance().stats().rejected > rejectedBefore);
+
+    CHECK(j.size() == count);
+    for (std::size_t i = 0; i + 1 < count; ++i)
+    {
+        std::string name = "fb_e" + std::to_string(i);
+        REQUIRE(j.isMember(name));
+        const Json::Value &child = j[name];
+        REQUIRE(child.isObject());
+        CHECK(child["@fb_a" + std::to_string(i)].asString() == "v");
+    }
+
+    REQUIRE(j[last].isArray());
+    CHECK(j[last].size() == 2);
+    CHECK(j[last][0]["@fb_a" + std::to_string(count - 1)].asString() == "v");
+    CHECK(j[last][1].isNull());
+}